@@ -105,6 +105,29 @@ int my_fallocator(File fd, my_off_t newlength, int filler, myf MyFlags) {
 #endif  // WIN32
   }
 
+#ifdef HAVE_POSIX_FALLOCATE
+  /*
+    Space reserved by posix_fallocate reads back as zeros, so there is no
+    need to write the zeros out one IO_SIZE buffer at a time. Fall back to
+    writing them if the file system does not support preallocation.
+  */
+  if (filler == 0) {
+    const int ret =
+        posix_fallocate(fd, (off_t)oldsize, (off_t)(newlength - oldsize));
+    if (ret == 0) {
+      if (my_seek(fd, newlength, MY_SEEK_SET, MYF(MY_WME + MY_FAE)) ==
+          MY_FILEPOS_ERROR) {
+        goto err;
+      }
+      DBUG_RETURN(0);
+    }
+    if (ret != EINVAL && ret != EOPNOTSUPP) {
+      set_my_errno(ret);
+      goto err;
+    }
+  }
+#endif
+
   /* Full file with 'filler' until it's as big as requested */
   memset(buff, filler, IO_SIZE);
   while (newlength - oldsize > IO_SIZE) {
@@ -49,6 +49,7 @@
 #include "mysql_com.h"
 #include "mysql_time.h"
 #include "mysqld_error.h"
+#include "prealloced_array.h"
 #include "sql/aggregate_check.h"  // Distinct_check
 #include "sql/check_stack.h"
 #include "sql/current_thd.h"  // current_thd
@@ -5078,13 +5079,40 @@ float Item_cond_and::get_filtering_effect(THD *thd, table_map filter_for_table,
   List_iterator<Item> it(list);
   Item *item;
 
+  if (!thd->optimizer_switch_flag(OPTIMIZER_SWITCH_FILTER_BACKOFF)) {
+    /*
+      Calculated as "Conjunction of independent events":
+         P(A and B ...) = P(A) * P(B) * ...
+    */
+    while ((item = it++))
+      filter *= item->get_filtering_effect(thd, filter_for_table, read_tables,
+                                           fields_to_ignore, rows_in_table);
+    return filter;
+  }
+
   /*
-    Calculated as "Conjunction of independent events":
-       P(A and B ...) = P(A) * P(B) * ...
+    Conditions on the same table are frequently correlated (e.g. country
+    and city), and multiplying their filtering effects then underestimates
+    the result by orders of magnitude. Use exponential backoff instead:
+       P(A and B and C ...) = P(A) * P(B)^(1/2) * P(C)^(1/4) * ...
+    where P(A) <= P(B) <= P(C) <= ..., so that the most selective
+    condition counts in full and each following one counts less.
   */
-  while ((item = it++))
-    filter *= item->get_filtering_effect(thd, filter_for_table, read_tables,
-                                         fields_to_ignore, rows_in_table);
+  Prealloced_array<float, 8> effects(PSI_NOT_INSTRUMENTED);
+  while ((item = it++)) {
+    const float effect = item->get_filtering_effect(
+        thd, filter_for_table, read_tables, fields_to_ignore, rows_in_table);
+    if (effect < COND_FILTER_ALLPASS && effects.push_back(effect))
+      return COND_FILTER_ALLPASS; /* purecov: inspected */
+  }
+
+  std::sort(effects.begin(), effects.end());
+
+  double exponent = 1.0;
+  for (float effect : effects) {
+    filter *= static_cast<float>(pow(effect, exponent));
+    exponent /= 2;
+  }
   return filter;
 }
 
@@ -1558,8 +1558,8 @@ longlong Item_func_json_depth::val_int() {
   null_value = args[0]->null_value;
   if (null_value) return 0;
 
-  const Json_dom *dom = wrapper.to_dom(current_thd);
-  return dom == nullptr ? error_int() : dom->depth();
+  const uint32 depth = wrapper.depth();
+  return depth == 0 ? error_int() : depth;
 }
 
 bool Item_func_json_keys::val_json(Json_wrapper *wr) {
@@ -1666,7 +1666,9 @@ bool Item_func_json_extract::val_json(Json_wrapper *wr) {
       if (a == nullptr) return error_json(); /* purecov: inspected */
       const THD *thd = current_thd;
       for (Json_wrapper &w : v) {
-        if (a->append_clone(w.to_dom(thd)))
+        // Build the DOM of a binary hit only once, instead of converting
+        // the wrapper and then cloning the result into the array.
+        if (a->append_alias(w.clone_dom(thd)))
           return error_json(); /* purecov: inspected */
       }
       *wr = Json_wrapper(std::move(a));
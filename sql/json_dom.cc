@@ -2239,6 +2239,44 @@ size_t Json_wrapper::length() const {
   }
 }
 
+#ifdef MYSQL_SERVER
+/**
+  Compute the depth of a binary JSON value.
+
+  @param v  the binary value
+  @return the depth of the value, or 0 if it contains an invalid value
+*/
+static uint32 binary_depth(const json_binary::Value &v) {
+  switch (v.type()) {
+    case json_binary::Value::ARRAY:
+    case json_binary::Value::OBJECT: {
+      uint32 deepest_child = 0;
+      for (size_t i = 0; i < v.element_count(); ++i) {
+        const uint32 child_depth = binary_depth(v.element(i));
+        if (child_depth == 0) return 0; /* purecov: inspected */
+        deepest_child = std::max(deepest_child, child_depth);
+      }
+      return 1 + deepest_child;
+    }
+    case json_binary::Value::ERROR:
+      return 0; /* purecov: inspected */
+    default:
+      return 1;
+  }
+}
+
+uint32 Json_wrapper::depth() const {
+  if (empty()) return 0; /* purecov: inspected */
+
+  if (m_is_dom) return m_dom_value->depth();
+
+  const uint32 result = binary_depth(m_value);
+  if (result == 0)
+    my_error(ER_INVALID_JSON_BINARY_DATA, MYF(0)); /* purecov: inspected */
+  return result;
+}
+#endif  // ifdef MYSQL_SERVER
+
 /**
   Compare two numbers of the same type.
   @param val1 the first number
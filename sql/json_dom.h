@@ -1549,6 +1549,18 @@ class Json_wrapper {
   */
   size_t length() const;
 
+#ifdef MYSQL_SERVER
+  /**
+    Compute the depth of a document. This is the value which would be
+    returned by the JSON_DEPTH() system function. A binary value is
+    walked in place, without building a DOM.
+
+    @returns the depth of the document, or 0 if the binary value is
+             corrupt (an error has then been raised)
+  */
+  uint32 depth() const;
+#endif
+
   /**
     Compare this JSON value to another JSON value.
     @param[in] other the other JSON value
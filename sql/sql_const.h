@@ -355,7 +355,13 @@ static const ulong EVENT_DEF_CACHE_MIN = 256;
 #define OPTIMIZER_SWITCH_DERIVED_MERGE (1ULL << 18)
 #define OPTIMIZER_SWITCH_USE_INVISIBLE_INDEXES (1ULL << 19)
 #define OPTIMIZER_SKIP_SCAN (1ULL << 20)
-#define OPTIMIZER_SWITCH_LAST (1ULL << 21)
+/**
+   If this is on, the filtering effects of the conditions in a conjunction
+   are not assumed to be independent: the least selective ones are damped by
+   exponential backoff, see Item_cond_and::get_filtering_effect().
+*/
+#define OPTIMIZER_SWITCH_FILTER_BACKOFF (1ULL << 21)
+#define OPTIMIZER_SWITCH_LAST (1ULL << 22)
 
 #define OPTIMIZER_SWITCH_DEFAULT                                          \
   (OPTIMIZER_SWITCH_INDEX_MERGE | OPTIMIZER_SWITCH_INDEX_MERGE_UNION |    \
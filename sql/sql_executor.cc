@@ -5298,19 +5298,22 @@ end:
 static enum_nested_loop_state end_update(JOIN *join, QEP_TAB *const qep_tab,
                                          bool end_of_records) {
   TABLE *const table = qep_tab->table();
+  Temp_table_param *const tmp_tbl = qep_tab->tmp_table_param;
   ORDER *group;
   int error;
   bool group_found = false;
   DBUG_ENTER("end_update");
 
-  if (end_of_records) DBUG_RETURN(NESTED_LOOP_OK);
+  if (end_of_records) {
+    tmp_tbl->last_group_key_valid = false;
+    DBUG_RETURN(NESTED_LOOP_OK);
+  }
   if (join->thd->killed)  // Aborted by user
   {
     join->thd->send_kill_message();
     DBUG_RETURN(NESTED_LOOP_KILLED); /* purecov: inspected */
   }
 
-  Temp_table_param *const tmp_tbl = qep_tab->tmp_table_param;
   join->found_records++;
 
   // See comment below.
@@ -5340,9 +5343,23 @@ static enum_nested_loop_state end_update(JOIN *join, QEP_TAB *const qep_tab,
         group->buff[-1] = (char)group->field_in_tmp_table->is_null();
     }
     const uchar *key = tmp_tbl->group_buff;
-    if (!table->file->ha_index_read_map(table->record[1], key, HA_WHOLE_KEY,
-                                        HA_READ_KEY_EXACT))
+    /*
+      Input rows often arrive clustered on the grouping columns. If this
+      row belongs to the group updated last, that group row is still in
+      record[1] and the handler is still positioned on it, so the index
+      lookup can be skipped. Equal key images imply equal keys; the
+      converse need not hold (e.g. case-insensitive collations), which
+      only means falling back to the lookup.
+    */
+    if (tmp_tbl->last_group_key_valid &&
+        memcmp(tmp_tbl->last_group_key, key, tmp_tbl->group_length) == 0)
       group_found = true;
+    else {
+      tmp_tbl->last_group_key_valid = false;
+      if (!table->file->ha_index_read_map(table->record[1], key, HA_WHOLE_KEY,
+                                          HA_READ_KEY_EXACT))
+        group_found = true;
+    }
   }
   if (group_found) {
     /* Update old record */
@@ -5351,9 +5368,30 @@ static enum_nested_loop_state end_update(JOIN *join, QEP_TAB *const qep_tab,
     if ((error =
              table->file->ha_update_row(table->record[1], table->record[0]))) {
       // Old and new records are the same, ok to ignore
-      if (error == HA_ERR_RECORD_IS_THE_SAME) DBUG_RETURN(NESTED_LOOP_OK);
-      table->file->print_error(error, MYF(0)); /* purecov: inspected */
-      DBUG_RETURN(NESTED_LOOP_ERROR);          /* purecov: inspected */
+      if (error != HA_ERR_RECORD_IS_THE_SAME) {
+        table->file->print_error(error, MYF(0)); /* purecov: inspected */
+        DBUG_RETURN(NESTED_LOOP_ERROR);          /* purecov: inspected */
+      }
+    }
+    /*
+      Only engines whose update_row() changes the row in place keep the
+      handler positioned on the group row. InnoDB intrinsic tables
+      delete-mark the old record and insert a new one, leaving the cursor
+      on the stale version, so they always need the lookup.
+    */
+    const handlerton *const hton = table->s->db_type();
+    if (!table->hash_field && table->s->blob_fields == 0 &&
+        (hton == temptable_hton || hton == heap_hton ||
+         hton == myisam_hton)) {
+      // Remember the group for the next row, see above.
+      if (tmp_tbl->last_group_key == nullptr &&
+          !(tmp_tbl->last_group_key = static_cast<uchar *>(
+                join->thd->alloc(tmp_tbl->group_length))))
+        DBUG_RETURN(NESTED_LOOP_ERROR); /* purecov: inspected */
+      memcpy(tmp_tbl->last_group_key, tmp_tbl->group_buff,
+             tmp_tbl->group_length);
+      store_record(table, record[1]);
+      tmp_tbl->last_group_key_valid = true;
     }
     DBUG_RETURN(NESTED_LOOP_OK);
   }
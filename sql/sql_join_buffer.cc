@@ -46,6 +46,8 @@
 #include "my_table_map.h"
 #include "sql/field.h"
 #include "sql/item.h"
+#include "sql/item_cmpfunc.h"  // Item_cond
+#include "sql/item_func.h"
 #include "sql/key.h"
 #include "sql/opt_trace.h"       // Opt_trace_object
 #include "sql/psi_memory_key.h"  // key_memory_JOIN_CACHE
@@ -671,11 +673,150 @@ int JOIN_CACHE_BNL::init() {
           .add("constant_condition_in_bnl", tmp);
       const_cond = tmp;
     }
+    if (init_key_filter()) DBUG_RETURN(1);
   }
 
   DBUG_RETURN(0);
 }
 
+/**
+  Return the field of an integer column referenced by item, provided that
+  item is a plain column reference to one of the given tables.
+*/
+
+static Field *get_key_filter_field(Item *item, table_map tables) {
+  if (item->type() != Item::FIELD_ITEM) return NULL;
+  Item_field *const item_field = down_cast<Item_field *>(item);
+  const table_map used = item_field->used_tables();
+  if (used == 0 || (used & ~tables) != 0) return NULL;
+  switch (item_field->field->type()) {
+    case MYSQL_TYPE_TINY:
+    case MYSQL_TYPE_SHORT:
+    case MYSQL_TYPE_INT24:
+    case MYSQL_TYPE_LONG:
+    case MYSQL_TYPE_LONGLONG:
+      return item_field->field;
+    default:
+      return NULL;
+  }
+}
+
+/**
+  Set up the Bloom filter over the join keys of the buffered records.
+
+  The conjuncts of the condition pushed to qep_tab are searched for
+  equalities between an integer column of qep_tab and an integer column of
+  a buffered table. If there are any, each record put into the join buffer
+  adds the values of its buffered columns to a Bloom filter, and each row
+  read from qep_tab is looked up in the filter before the join buffer is
+  read back. A row whose values are not in the filter cannot satisfy the
+  equalities for any buffered record, so it is skipped at once instead of
+  being checked against every record in the buffer. Rows that pass the
+  filter are checked with the full condition as before.
+
+  @returns false if success, otherwise true.
+*/
+
+bool JOIN_CACHE_BNL::init_key_filter() {
+  Item *const cond = qep_tab->condition();
+  const table_map inner_map = qep_tab->table_ref->map();
+  // Only columns of tables whose records are kept in the join buffers
+  table_map outer_map = 0;
+  for (JOIN_CACHE *cache = this; cache != NULL; cache = cache->prev_cache) {
+    for (uint i = 1; i <= cache->tables; i++)
+      outer_map |= cache->qep_tab[-static_cast<int>(i)].table_ref->map();
+  }
+
+  List<Item> single_conjunct;
+  List<Item> *conjuncts = &single_conjunct;
+  if (cond->type() == Item::COND_ITEM &&
+      down_cast<Item_cond *>(cond)->functype() == Item_func::COND_AND_FUNC)
+    conjuncts = down_cast<Item_cond *>(cond)->argument_list();
+  else if (single_conjunct.push_back(cond))
+    return true;
+
+  key_filter_fields =
+      (Field **)sql_alloc(sizeof(Field *) * 2 * conjuncts->elements);
+  if (key_filter_fields == NULL) return true;
+
+  List_iterator<Item> it(*conjuncts);
+  Item *item;
+  while ((item = it++)) {
+    if (item->type() != Item::FUNC_ITEM ||
+        down_cast<Item_func *>(item)->functype() != Item_func::EQ_FUNC)
+      continue;
+    Item **const args = down_cast<Item_func *>(item)->arguments();
+    for (uint i = 0; i < 2; i++) {
+      Field *const inner_field = get_key_filter_field(args[i], inner_map);
+      Field *const outer_field = get_key_filter_field(args[1 - i], outer_map);
+      if (inner_field != NULL && outer_field != NULL) {
+        key_filter_fields[2 * key_filter_field_count] = inner_field;
+        key_filter_fields[2 * key_filter_field_count + 1] = outer_field;
+        key_filter_field_count++;
+        break;
+      }
+    }
+  }
+  if (key_filter_field_count == 0) return false;
+
+  /*
+    Use about one bit per byte of the join buffer, which leaves several bits
+    per buffered record.
+  */
+  uint n_bits = 64;
+  while (n_bits * 2 <= buff_size && n_bits < (1U << 23)) n_bits *= 2;
+  my_bitmap_map *const map_buf =
+      (my_bitmap_map *)sql_alloc(bitmap_buffer_size(n_bits));
+  if (map_buf == NULL) return true;
+  bitmap_init(&key_filter, map_buf, n_bits, false);
+  return false;
+}
+
+/**
+  Hash the current values of one side of the key filter columns.
+
+  @param       side     0 for the columns of the joined table,
+                        1 for the columns of the buffered tables
+  @param[out]  is_null  set to true if one of the columns is NULL
+
+  @returns the hash value
+*/
+
+ulonglong JOIN_CACHE_BNL::key_filter_hash(uint side, bool *is_null) const {
+  ulonglong hash = 0;
+  for (uint i = 0; i < key_filter_field_count; i++) {
+    Field *const field = key_filter_fields[2 * i + side];
+    if (field->is_null()) {
+      *is_null = true;
+      return 0;
+    }
+    hash = (hash ^ static_cast<ulonglong>(field->val_int())) *
+           0x9E3779B97F4A7C15ULL;
+    hash ^= hash >> 29;
+  }
+  *is_null = false;
+  return hash;
+}
+
+bool JOIN_CACHE_BNL::put_record_in_cache() {
+  if (key_filter_field_count > 0) {
+    bool is_null;
+    const ulonglong hash = key_filter_hash(1, &is_null);
+    // A NULL key never satisfies '=', so it need not be in the filter.
+    if (!is_null) {
+      const uint mask = key_filter.n_bits - 1;
+      bitmap_set_bit(&key_filter, static_cast<uint>(hash) & mask);
+      bitmap_set_bit(&key_filter, static_cast<uint>(hash >> 32) & mask);
+    }
+  }
+  return JOIN_CACHE::put_record_in_cache();
+}
+
+void JOIN_CACHE_BNL::reset_cache(bool for_writing) {
+  JOIN_CACHE::reset_cache(for_writing);
+  if (for_writing && key_filter_field_count > 0) bitmap_clear_all(&key_filter);
+}
+
 /*
   Initialize a BKA cache
 
@@ -1886,6 +2027,19 @@ enum_nested_loop_state JOIN_CACHE_BNL::join_matching_records(bool skip_last) {
           return NESTED_LOOP_ERROR;
         if (!consider_record) continue;
       }
+      if (key_filter_field_count > 0) {
+        /*
+          Skip the record if its join key is not in the filter built over
+          the records of the join buffer: it cannot match any of them.
+        */
+        bool is_null;
+        const ulonglong hash = key_filter_hash(0, &is_null);
+        const uint mask = key_filter.n_bits - 1;
+        if (is_null ||
+            !bitmap_is_set(&key_filter, static_cast<uint>(hash) & mask) ||
+            !bitmap_is_set(&key_filter, static_cast<uint>(hash >> 32) & mask))
+          continue;
+      }
       {
         /* Prepare to read records from the join buffer */
         reset_cache(false);
@@ -26,6 +26,7 @@
 #include <string.h>
 #include <sys/types.h>
 
+#include "my_bitmap.h"
 #include "my_byteorder.h"
 #include "my_dbug.h"
 #include "my_inttypes.h"
@@ -553,16 +554,40 @@ class JOIN_CACHE_BNL final : public JOIN_CACHE {
  protected:
   enum_nested_loop_state join_matching_records(bool skip_last) override;
 
+  bool put_record_in_cache() override;
+
  public:
   JOIN_CACHE_BNL(JOIN *j, QEP_TAB *qep_tab_arg, JOIN_CACHE *prev)
-      : JOIN_CACHE(j, qep_tab_arg, prev), const_cond(NULL) {}
+      : JOIN_CACHE(j, qep_tab_arg, prev),
+        const_cond(NULL),
+        key_filter_fields(NULL),
+        key_filter_field_count(0) {}
 
   int init() override;
 
+  void reset_cache(bool for_writing) override;
+
   enum_join_cache_type cache_type() const override { return ALG_BNL; }
 
  private:
+  bool init_key_filter();
+  ulonglong key_filter_hash(uint side, bool *is_null) const;
+
   Item *const_cond;
+
+  /**
+    Pairs of integer columns compared with '=' in the condition pushed to
+    qep_tab: key_filter_fields[2 * i] belongs to the joined table and
+    key_filter_fields[2 * i + 1] to one of the buffered tables.
+  */
+  Field **key_filter_fields;
+  /// Number of column pairs in key_filter_fields, 0 if there is no filter
+  uint key_filter_field_count;
+  /**
+    Bloom filter over the values of the buffered columns of
+    key_filter_fields for all records currently in the join buffer.
+  */
+  MY_BITMAP key_filter;
 };
 
 class JOIN_CACHE_BKA : public JOIN_CACHE {
@@ -1360,6 +1360,8 @@ void JOIN::reset() {
   if (tmp_tables) {
     for (uint tmp = primary_tables; tmp < primary_tables + tmp_tables; tmp++) {
       TABLE *const tmp_table = qep_tab[tmp].table();
+      if (qep_tab[tmp].tmp_table_param != nullptr)
+        qep_tab[tmp].tmp_table_param->last_group_key_valid = false;
       if (!tmp_table->is_created()) continue;
       tmp_table->file->extra(HA_EXTRA_RESET_STATE);
       tmp_table->file->ha_delete_all_rows();
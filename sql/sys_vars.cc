@@ -2794,6 +2794,7 @@ static const char *optimizer_switch_names[] = {
     "derived_merge",
     "use_invisible_indexes",
     "skip_scan",
+    "filter_backoff",
     "default",
     NullS};
 static Sys_var_flagset Sys_optimizer_switch(
@@ -85,6 +85,16 @@ class Temp_table_param {
   Memroot_vector<Copy_field> copy_fields;
 
   uchar *group_buff;
+  /**
+    Used by end_update(): copy of group_buff for the last group that was
+    found and updated in the temporary table. While last_group_key_valid
+    is true, the group row is in the table's record[1] and the handler is
+    positioned on it, so that a following row of the same group can be
+    aggregated without an index lookup. Only used for temporary tables in
+    TempTable, MEMORY and MyISAM, which update rows in place.
+  */
+  uchar *last_group_key;
+  bool last_group_key_valid;
   Func_ptr_array *items_to_copy; /* Fields in tmp table */
   MI_COLUMNDEF *recinfo, *start_recinfo;
 
@@ -174,6 +184,8 @@ class Temp_table_param {
       : grouped_expressions(Memroot_allocator<Item_copy *>(mem_root)),
         copy_fields(Memroot_allocator<Copy_field>(mem_root)),
         group_buff(nullptr),
+        last_group_key(nullptr),
+        last_group_key_valid(false),
         items_to_copy(nullptr),
         recinfo(NULL),
         start_recinfo(NULL),
@@ -40,6 +40,17 @@ this program; if not, write to the Free Software Foundation, Inc.,
 /** Innodb B-tree index fill factor for bulk load. */
 long innobase_fill_factor;
 
+/** Get the page fill factor for bulk load of an index.
+@param[in]	index	index being loaded
+@return FILLFACTOR of the index if set, otherwise innodb_fill_factor */
+static inline ulint btr_bulk_fill_factor(const dict_index_t *index) {
+  if (index->fill_factor != DICT_INDEX_FILL_FACTOR_DEFAULT) {
+    return (index->fill_factor);
+  }
+
+  return (static_cast<ulint>(innobase_fill_factor));
+}
+
 /** Initialize members, allocate page if needed and start mtr.
 Note: we commit all mtrs on failure.
 @return error code. */
@@ -137,11 +148,13 @@ dberr_t PageBulk::init() {
   ut_ad(m_is_comp == !!page_is_comp(new_page));
   m_free_space = page_get_free_space_of_empty(m_is_comp);
 
-  if (innobase_fill_factor == 100 && m_index->is_clustered()) {
+  const ulint fill_factor = btr_bulk_fill_factor(m_index);
+
+  if (fill_factor == 100 && m_index->is_clustered()) {
     /* Keep default behavior compatible with 5.6 */
     m_reserved_space = dict_index_get_space_reserve();
   } else {
-    m_reserved_space = UNIV_PAGE_SIZE * (100 - innobase_fill_factor) / 100;
+    m_reserved_space = UNIV_PAGE_SIZE * (100 - fill_factor) / 100;
   }
 
   m_padding_space =
@@ -328,7 +341,8 @@ void PageBulk::commit(bool success) {
     /* Set no free space left and no buffered changes in ibuf. */
     if (!m_index->is_clustered() && !m_index->table->is_temporary() &&
         page_is_leaf(m_page)) {
-      ibuf_set_bitmap_for_bulk_load(m_block, innobase_fill_factor == 100);
+      ibuf_set_bitmap_for_bulk_load(m_block,
+                                    btr_bulk_fill_factor(m_index) == 100);
     }
   }
 
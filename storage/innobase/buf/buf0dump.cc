@@ -75,6 +75,11 @@ typedef ib_uint64_t buf_dump_t;
 #define BUF_DUMP_SPACE(a) static_cast<space_id_t>((a) >> 32)
 #define BUF_DUMP_PAGE(a) static_cast<page_no_t>((a)&0xFFFFFFFFUL)
 
+/** Number of pages that buf_load() sorts and submits together. The pages
+of the dump are ordered from hot to cold; sorting within a batch makes the
+reads sequential without loading cold pages ahead of hot ones. */
+static const ulint BUF_LOAD_BATCH_SIZE = 16384;
+
 /** Wakes up the buffer pool dump/load thread and instructs it to start
  a dump. This function is called by MySQL code via buffer_pool_dump_now()
  and it should return immediately because the whole MySQL is frozen during
@@ -223,6 +228,20 @@ void buf_dump_generate_path(char *path, size_t path_size) {
   }
 }
 
+/** Free the per buffer pool instance LRU snapshots taken by buf_dump().
+@param[in,out]	dumps	snapshot of each instance, NULL if it was skipped
+@param[in,out]	dumps_n	number of pages in each snapshot */
+static void buf_dump_free(buf_dump_t **dumps, ulint *dumps_n) {
+  for (ulint i = 0; i < srv_buf_pool_instances; i++) {
+    if (dumps[i] != NULL) {
+      ut_free(dumps[i]);
+    }
+  }
+
+  ut_free(dumps);
+  ut_free(dumps_n);
+}
+
 /** Perform a buffer pool dump into the file specified by
 innodb_buffer_pool_filename. If any errors occur then the value of
 innodb_buffer_pool_dump_status will be set accordingly, see buf_dump_status().
@@ -253,6 +272,24 @@ static void buf_dump(ibool obey_shutdown) {
   }
   /* else */
 
+  /* Snapshot the LRU list of every buffer pool instance first. Each
+  snapshot is ordered from the most to the least recently used page. */
+  buf_dump_t **dumps = static_cast<buf_dump_t **>(
+      ut_zalloc_nokey(srv_buf_pool_instances * sizeof(*dumps)));
+  ulint *dumps_n = static_cast<ulint *>(
+      ut_zalloc_nokey(srv_buf_pool_instances * sizeof(*dumps_n)));
+  ulint max_n_pages = 0;
+  ulint total_n_pages = 0;
+
+  if (dumps == NULL || dumps_n == NULL) {
+    ut_free(dumps);
+    ut_free(dumps_n);
+    fclose(f);
+    buf_dump_status(STATUS_ERR, "Cannot allocate memory: %s", strerror(errno));
+    /* leave tmp_filename to exist */
+    return;
+  }
+
   /* walk through each buffer pool */
   for (i = 0; i < srv_buf_pool_instances && !SHOULD_QUIT(); i++) {
     buf_pool_t *buf_pool;
@@ -289,6 +326,7 @@ static void buf_dump(ibool obey_shutdown) {
 
     if (dump == NULL) {
       mutex_exit(&buf_pool->LRU_list_mutex);
+      buf_dump_free(dumps, dumps_n);
       fclose(f);
       buf_dump_status(STATUS_ERR, "Cannot allocate " ULINTPF " bytes: %s",
                       (ulint)(n_pages * sizeof(*dump)), strerror(errno));
@@ -308,11 +346,27 @@ static void buf_dump(ibool obey_shutdown) {
 
     mutex_exit(&buf_pool->LRU_list_mutex);
 
-    for (j = 0; j < n_pages && !SHOULD_QUIT(); j++) {
-      ret = fprintf(f, SPACE_ID_PF "," PAGE_NO_PF "\n", BUF_DUMP_SPACE(dump[j]),
-                    BUF_DUMP_PAGE(dump[j]));
+    dumps[i] = dump;
+    dumps_n[i] = n_pages;
+    max_n_pages = std::max(max_n_pages, n_pages);
+    total_n_pages += n_pages;
+  }
+
+  /* Write the pages ordered by heat: interleave the instances by their
+  LRU position, so that the hottest pages of all instances come first
+  in the file and are the first ones to be read back by buf_load(). */
+  ulint n_written = 0;
+
+  for (ulint j = 0; j < max_n_pages && !SHOULD_QUIT(); j++) {
+    for (i = 0; i < srv_buf_pool_instances; i++) {
+      if (j >= dumps_n[i]) {
+        continue;
+      }
+
+      ret = fprintf(f, SPACE_ID_PF "," PAGE_NO_PF "\n",
+                    BUF_DUMP_SPACE(dumps[i][j]), BUF_DUMP_PAGE(dumps[i][j]));
       if (ret < 0) {
-        ut_free(dump);
+        buf_dump_free(dumps, dumps_n);
         fclose(f);
         buf_dump_status(STATUS_ERR, "Cannot write to '%s': %s", tmp_filename,
                         strerror(errno));
@@ -320,19 +374,19 @@ static void buf_dump(ibool obey_shutdown) {
         return;
       }
 
-      if (j % 128 == 0) {
+      if (n_written % 128 == 0) {
         buf_dump_status(STATUS_VERBOSE,
-                        "Dumping buffer pool"
-                        " " ULINTPF "/" ULINTPF
-                        ","
+                        "Dumping buffer pool(s)"
                         " page " ULINTPF "/" ULINTPF,
-                        i + 1, srv_buf_pool_instances, j + 1, n_pages);
+                        n_written + 1, total_n_pages);
       }
-    }
 
-    ut_free(dump);
+      ++n_written;
+    }
   }
 
+  buf_dump_free(dumps, dumps_n);
+
   ret = fclose(f);
   if (ret != 0) {
     buf_dump_status(STATUS_ERR, "Cannot close '%s': %s", tmp_filename,
@@ -565,8 +619,14 @@ static void buf_load() {
     return;
   }
 
-  if (!SHUTTING_DOWN()) {
-    std::sort(dump, dump + dump_n);
+  /* The dump lists the hottest pages first. Sort each batch by
+  (space, page) so that the reads within a batch are sequential, but keep
+  the batches in file order so that hot pages are loaded before cold ones.
+  A dump written in plain (space, page) order stays sorted. */
+  for (ulint batch = 0; batch < dump_n && !SHUTTING_DOWN();
+       batch += BUF_LOAD_BATCH_SIZE) {
+    std::sort(dump + batch,
+              dump + std::min(batch + BUF_LOAD_BATCH_SIZE, dump_n));
   }
 
   ulint last_check_time = 0;
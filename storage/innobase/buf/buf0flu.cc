@@ -92,6 +92,10 @@ static ulint buf_flush_lsn_scan_factor = 3;
 /** Average redo generation rate */
 static lsn_t lsn_avg_rate = 0;
 
+/** Measured time spent by one page cleaner thread to write out one page
+from the flush_list, in microseconds. Zero until the first measurement. */
+static ulint flush_list_us_per_page = 0;
+
 /** Target oldest LSN for the requested flush_sync */
 static lsn_t buf_flush_sync_lsn = 0;
 
@@ -2327,6 +2331,50 @@ static ulint af_get_pct_for_lsn(lsn_t age) /*!< in: current age of LSN. */
                              7.5));
 }
 
+ulint buf_flush_steer_n_pages(buf_flush_steer_t *steer, ulint n_pages,
+                              ulint pct_for_lsn, lsn_t age, ulint us_per_page,
+                              ulint n_cleaners, ulint io_capacity) {
+  /* Following each one second sample directly makes the flushing rate
+  oscillate under bursty writes: a burst drives the target up, the
+  checkpoint age collapses, the target drops and the age builds up again
+  until the async flush point is hit. */
+  const bool age_growing = age > steer->prev_age;
+  const ulint prev = steer->prev_n_pages;
+  ulint target;
+
+  steer->prev_age = age;
+
+  if (pct_for_lsn >= 100) {
+    /* Redo space is running out, follow the recommendation at once. */
+    target = n_pages;
+
+  } else if (n_pages >= prev) {
+    const ulint div = age_growing ? 2 : 4;
+
+    target = prev + (n_pages - prev + div - 1) / div;
+
+  } else {
+    const ulint div = age_growing ? 8 : 2;
+
+    target = prev - (prev - n_pages + div - 1) / div;
+  }
+
+  if (us_per_page > 0 && pct_for_lsn < 100) {
+    /* Requesting more than the devices can absorb in one iteration
+    only makes the coordinator overrun its one second loop and wait
+    for the slowest buffer pool instance. */
+    ulint capacity = n_cleaners * 1000000 / us_per_page;
+
+    capacity = std::max(capacity, io_capacity);
+
+    target = std::min(target, capacity);
+  }
+
+  steer->prev_n_pages = target;
+
+  return (target);
+}
+
 /** This function is called approximately once every second by the
  page_cleaner thread. Based on various factors it decides if there is a
  need to do flushing.
@@ -2438,6 +2486,12 @@ static ulint page_cleaner_flush_pages_recommendation(lsn_t *lsn_limit,
       flush_pass = 1;
     }
 
+    /* Only trust the per page cost when enough pages were written for
+    the fixed cost of scanning the flush_list not to dominate it. */
+    if (sum_pages >= 100) {
+      flush_list_us_per_page = std::max<ulint>(list_tm * 1000 / sum_pages, 1);
+    }
+
     MONITOR_SET(MONITOR_FLUSH_ADAPTIVE_AVG_TIME_SLOT, list_tm / list_pass);
     MONITOR_SET(MONITOR_LRU_BATCH_FLUSH_AVG_TIME_SLOT, lru_tm / lru_pass);
 
@@ -2515,6 +2569,12 @@ static ulint page_cleaner_flush_pages_recommendation(lsn_t *lsn_limit,
 
   n_pages = (PCT_IO(pct_total) + avg_page_rate + pages_for_lsn) / 3;
 
+  static buf_flush_steer_t steer;
+
+  n_pages = buf_flush_steer_n_pages(&steer, n_pages, pct_for_lsn, age,
+                                    flush_list_us_per_page,
+                                    srv_n_page_cleaners, srv_io_capacity);
+
   if (n_pages > srv_max_io_capacity) {
     n_pages = srv_max_io_capacity;
   }
@@ -666,13 +666,22 @@ void buf_read_ibuf_merge_pages(
   ut_a(n_stored < UNIV_PAGE_SIZE);
 #endif
 
+  /* The pages of a merge batch are normally all in the same
+  tablespace, so look up the page size only when the space id changes
+  instead of going through the tablespace cache for every page. */
+  space_id_t prev_space_id = SPACE_UNKNOWN;
+  page_size_t page_size(0, 0, false);
+  bool found = false;
+
   for (ulint i = 0; i < n_stored; i++) {
     const page_id_t page_id(space_ids[i], page_nos[i]);
 
     buf_pool_t *buf_pool = buf_pool_get(page_id);
 
-    bool found;
-    const page_size_t page_size(fil_space_get_page_size(space_ids[i], &found));
+    if (space_ids[i] != prev_space_id) {
+      page_size.copy_from(fil_space_get_page_size(space_ids[i], &found));
+      prev_space_id = space_ids[i];
+    }
 
     if (!found) {
       /* The tablespace was not found, remove the
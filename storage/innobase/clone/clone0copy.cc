@@ -29,6 +29,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
  *******************************************************/
 
+#include <algorithm>
+
 #include "buf0dump.h"
 #include "clone0clone.h"
 #include "dict0dict.h"
@@ -194,6 +196,11 @@ dberr_t Clone_Snapshot::init_page_copy(byte *page_buffer,
                                        uint page_buffer_len) {
   dberr_t err = DB_SUCCESS;
 
+  auto equal_page = [](const Clone_Page &page1, const Clone_Page &page2) {
+    return (page1.m_space_id == page2.m_space_id &&
+            page1.m_page_no == page2.m_page_no);
+  };
+
   ut_ad(m_snapshot_handle_type == CLONE_HDL_COPY);
 
   if (m_snapshot_type == HA_CLONE_HYBRID) {
@@ -227,7 +234,28 @@ dberr_t Clone_Snapshot::init_page_copy(byte *page_buffer,
   err = m_page_ctx.get_pages(add_page_callback, context, page_buffer,
                              page_buffer_len);
 
-  m_page_vector.assign(m_page_set.begin(), m_page_set.end());
+  if (err != DB_SUCCESS) {
+    goto func_end;
+  }
+
+  /* The archiver reports a page for every time it was modified. Sorting
+  once and removing the duplicates is much cheaper than keeping a tree
+  of the page IDs when millions of pages are tracked. */
+  std::sort(m_page_vector.begin(), m_page_vector.end(), Less_Clone_Page());
+
+  m_num_duplicate_pages = static_cast<uint>(m_page_vector.size());
+
+  m_page_vector.erase(
+      std::unique(m_page_vector.begin(), m_page_vector.end(), equal_page),
+      m_page_vector.end());
+
+  m_num_pages = static_cast<uint>(m_page_vector.size());
+  m_num_duplicate_pages -= m_num_pages;
+
+#ifdef HAVE_PSI_STAGE_INTERFACE
+  m_monitor.add_estimate(static_cast<ib_uint64_t>(m_num_pages) *
+                         UNIV_PAGE_SIZE);
+#endif
 
   aligned_size = ut_calc_align(m_num_pages, chunk_size());
   m_num_current_chunks = aligned_size >> m_chunk_size_pow2;
@@ -502,7 +530,7 @@ dberr_t Clone_Snapshot::add_node(fil_node_t *node) {
   return (DB_SUCCESS);
 }
 
-/** Add page ID to to the set of pages in snapshot
+/** Add page ID to to the pages in snapshot
 @param[in]	space_id	page tablespace
 @param[in]	page_num	page number within tablespace
 @return error code */
@@ -512,16 +540,8 @@ dberr_t Clone_Snapshot::add_page(ib_uint32_t space_id, ib_uint32_t page_num) {
   cur_page.m_space_id = space_id;
   cur_page.m_page_no = page_num;
 
-  auto result = m_page_set.insert(cur_page);
-
-  if (result.second) {
-    m_num_pages++;
-#ifdef HAVE_PSI_STAGE_INTERFACE
-    m_monitor.add_estimate(UNIV_PAGE_SIZE);
-#endif
-  } else {
-    m_num_duplicate_pages++;
-  }
+  /* Duplicates are removed once all pages are added. */
+  m_page_vector.push_back(cur_page);
 
   return (DB_SUCCESS);
 }
@@ -2305,6 +2305,31 @@ static ulint dd_parse_merge_threshold(THD *thd, const char *str) {
   return (DICT_INDEX_MERGE_THRESHOLD_DEFAULT);
 }
 
+/** Parse FILLFACTOR value from a comment string.
+@param[in]      thd     connection
+@param[in]      str     string which might include 'FILLFACTOR='
+@return value parsed
+@retval DICT_INDEX_FILL_FACTOR_DEFAULT for missing or invalid value. */
+static ulint dd_parse_fill_factor(THD *thd, const char *str) {
+  static constexpr char label[] = "FILLFACTOR=";
+  const char *pos = strstr(str, label);
+
+  if (pos != nullptr) {
+    pos += (sizeof label) - 1;
+
+    int ret = atoi(pos);
+
+    if (ret >= 10 && ret <= 100) {
+      return (static_cast<ulint>(ret));
+    }
+
+    push_warning_printf(thd, Sql_condition::SL_WARNING, WARN_OPTION_IGNORED,
+                        ER_DEFAULT(WARN_OPTION_IGNORED), "FILLFACTOR");
+  }
+
+  return (DICT_INDEX_FILL_FACTOR_DEFAULT);
+}
+
 /** Copy attributes from MySQL TABLE_SHARE into an InnoDB table object.
 @param[in,out]	thd		thread context
 @param[in,out]	table		InnoDB table
@@ -2341,9 +2366,14 @@ inline void dd_copy_from_table_share(THD *thd, dict_table_t *table,
       table_share->comment.str
           ? dd_parse_merge_threshold(thd, table_share->comment.str)
           : DICT_INDEX_MERGE_THRESHOLD_DEFAULT;
+  const ulint fill_factor_table =
+      table_share->comment.str
+          ? dd_parse_fill_factor(thd, table_share->comment.str)
+          : DICT_INDEX_FILL_FACTOR_DEFAULT;
   dict_index_t *index = table->first_index();
 
   index->merge_threshold = merge_threshold_table;
+  index->fill_factor = fill_factor_table;
 
   if (dict_index_is_auto_gen_clust(index)) {
     index = index->next();
@@ -2357,8 +2387,14 @@ inline void dd_copy_from_table_share(THD *thd, dict_table_t *table,
     if (key_info->flags & HA_USES_COMMENT && key_info->comment.str != nullptr) {
       index->merge_threshold =
           dd_parse_merge_threshold(thd, key_info->comment.str);
+      index->fill_factor = dd_parse_fill_factor(thd, key_info->comment.str);
+
+      if (index->fill_factor == DICT_INDEX_FILL_FACTOR_DEFAULT) {
+        index->fill_factor = fill_factor_table;
+      }
     } else {
       index->merge_threshold = merge_threshold_table;
+      index->fill_factor = fill_factor_table;
     }
 
     index = index->next();
@@ -1322,22 +1322,23 @@ static ib_vector_t *fts_optimize_word(
 }
 
 /** Update the FTS index table. This is a delete followed by an insert.
+The prepared statements are kept in graph and reused for the following
+words, the caller must free them when it moves on to another auxiliary
+index table.
  @return DB_SUCCESS or error code */
 static MY_ATTRIBUTE((warn_unused_result)) dberr_t fts_optimize_write_word(
-    trx_t *trx,             /*!< in: transaction */
-    fts_table_t *fts_table, /*!< in: table of FTS index */
-    fts_string_t *word,     /*!< in: word data to write */
-    ib_vector_t *nodes)     /*!< in: the nodes to write */
+    trx_t *trx,                  /*!< in: transaction */
+    fts_table_t *fts_table,      /*!< in: table of FTS index */
+    fts_string_t *word,          /*!< in: word data to write */
+    ib_vector_t *nodes,          /*!< in: the nodes to write */
+    fts_optimize_graph_t *graph) /*!< in/out: prepared statements */
 {
   ulint i;
   pars_info_t *info;
-  que_t *graph;
   ulint selected;
   dberr_t error = DB_SUCCESS;
   char table_name[MAX_FULL_NAME_LEN];
 
-  info = pars_info_create();
-
   ut_ad(fts_table->charset);
 
   if (fts_enable_diag_print) {
@@ -1345,18 +1346,27 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t fts_optimize_write_word(
         << "FTS_OPTIMIZE: processed \"" << word->f_str << "\"";
   }
 
-  pars_info_bind_varchar_literal(info, "word", word->f_str, word->f_len);
-
   selected = fts_select_index(fts_table->charset, word->f_str, word->f_len);
 
   fts_table->suffix = fts_get_suffix(selected);
-  fts_get_table_name(fts_table, table_name);
-  pars_info_bind_id(info, true, "table_name", table_name);
 
-  graph = fts_parse_sql(fts_table, info,
-                        "BEGIN DELETE FROM $table_name WHERE word = :word;");
+  if (graph->delete_nodes_graph != NULL) {
+    info = graph->delete_nodes_graph->info;
+  } else {
+    info = pars_info_create();
 
-  error = fts_eval_sql(trx, graph);
+    fts_get_table_name(fts_table, table_name);
+    pars_info_bind_id(info, true, "table_name", table_name);
+  }
+
+  pars_info_bind_varchar_literal(info, "word", word->f_str, word->f_len);
+
+  if (graph->delete_nodes_graph == NULL) {
+    graph->delete_nodes_graph = fts_parse_sql(
+        fts_table, info, "BEGIN DELETE FROM $table_name WHERE word = :word;");
+  }
+
+  error = fts_eval_sql(trx, graph->delete_nodes_graph);
 
   if (error != DB_SUCCESS) {
     ib::error(ER_IB_MSG_493) << "(" << ut_strerr(error)
@@ -1364,9 +1374,6 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t fts_optimize_write_word(
                                 " when deleting a word from the FTS index.";
   }
 
-  fts_que_graph_free(graph);
-  graph = NULL;
-
   /* Even if the operation needs to be rolled back and redone,
   we iterate over the nodes in order to free the ilist. */
   for (i = 0; i < ib_vector_size(nodes); ++i) {
@@ -1379,7 +1386,8 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t fts_optimize_write_word(
         continue;
       }
 
-      error = fts_write_node(trx, &graph, fts_table, word, node);
+      error = fts_write_node(trx, &graph->write_nodes_graph, fts_table, word,
+                             node);
 
       if (error != DB_SUCCESS) {
         ib::error(ER_IB_MSG_494) << "(" << ut_strerr(error)
@@ -1394,10 +1402,6 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t fts_optimize_write_word(
     node->ilist_size = node->ilist_size_alloc = 0;
   }
 
-  if (graph != NULL) {
-    fts_que_graph_free(graph);
-  }
-
   return (error);
 }
 
@@ -1438,7 +1442,7 @@ static MY_ATTRIBUTE((warn_unused_result)) dberr_t fts_optimize_compact(
 
     /* Update the data on disk. */
     error = fts_optimize_write_word(trx, &optim->fts_index_table, &word->text,
-                                    nodes);
+                                    nodes, &optim->graph);
 
     if (error == DB_SUCCESS) {
       /* Write the last word optimized to the config table,
@@ -1662,10 +1666,15 @@ static void fts_optimize_words(
         if (!fts_zip_read_word(optim->zip, word)) {
           optim->done = TRUE;
         } else if (selected !=
-                       fts_select_index(charset, word->f_str, word->f_len) &&
-                   graph) {
-          fts_que_graph_free(graph);
-          graph = NULL;
+                   fts_select_index(charset, word->f_str, word->f_len)) {
+          /* The next word is in another auxiliary index
+          table, the prepared statements must be rebuilt. */
+          if (graph != NULL) {
+            fts_que_graph_free(graph);
+            graph = NULL;
+          }
+
+          fts_optimize_graph_free(&optim->graph);
         }
       }
     } else if (error == DB_LOCK_WAIT_TIMEOUT) {
@@ -1685,6 +1694,8 @@ static void fts_optimize_words(
   if (graph != NULL) {
     fts_que_graph_free(graph);
   }
+
+  fts_optimize_graph_free(&optim->graph);
 }
 
 /** Optimize is complete. Set the completion time, and reset the optimize
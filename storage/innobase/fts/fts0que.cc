@@ -3816,9 +3816,14 @@ void fts_query_free_result(
   }
 }
 
-/** FTS Query sort result, returned by fts_query() on fts_ranking_t::rank. */
+/** FTS Query sort result, returned by fts_query() on fts_ranking_t::rank.
+When the caller reads only the first limit documents, only the top ranked
+ones are kept, so the rank tree stays small however many documents match. */
 void fts_query_sort_result_on_rank(
-    fts_result_t *result) /*!< out: result instance to sort.*/
+    fts_result_t *result, /*!< out: result instance to sort.*/
+    ulonglong limit)      /*!< in: number of highest ranked
+                          documents to keep, or
+                          ULONG_UNDEFINED to keep all */
 {
   const ib_rbt_node_t *node;
   ib_rbt_t *ranked;
@@ -3840,6 +3845,19 @@ void fts_query_sort_result_on_rank(
 
     ut_a(ranking->words == NULL);
 
+    if (limit != ULONG_UNDEFINED && rbt_size(ranked) >= limit) {
+      const ib_rbt_node_t *last = rbt_last(ranked);
+
+      /* Skip documents that rank no higher than the
+      lowest ranked one that we are keeping. */
+      if (last == NULL ||
+          ranking->rank <= rbt_value(fts_ranking_t, last)->rank) {
+        continue;
+      }
+
+      ut_free(rbt_remove_node(ranked, last));
+    }
+
     rbt_insert(ranked, ranking, ranking);
   }
 
@@ -9352,6 +9352,7 @@ FT_INFO *ha_innobase::ft_init_ext(uint flags,  /* in: */
   fts_hdl->could_you = const_cast<_ft_vft_ext *>(&ft_vft_ext_result);
   fts_hdl->ft_prebuilt = m_prebuilt;
   fts_hdl->ft_result = result;
+  fts_hdl->ft_sort_limit = ULONG_UNDEFINED;
 
   /* FIXME: Re-evaluate the condition when Bug 14469540 is resolved */
   m_prebuilt->in_fts_query = true;
@@ -9373,7 +9374,18 @@ FT_INFO *ha_innobase::ft_init_ext_with_hints(uint keynr,      /* in: key num */
     m_prebuilt->m_fts_limit = ULONG_UNDEFINED;
   }
 
-  return (ft_init_ext(hints->get_flags(), keynr, key));
+  FT_INFO *ft_info = ft_init_ext(hints->get_flags(), keynr, key);
+
+  /* If the rows are read in rank order and only the first ones are
+  read, only those need to be sorted. See Item_func_match::set_hints(). */
+  if (ft_info != NULL && (hints->get_flags() & FT_SORTED) &&
+      !(hints->get_flags() & FT_NO_RANKING) &&
+      hints->get_limit() != HA_POS_ERROR) {
+    reinterpret_cast<NEW_FT_INFO *>(ft_info)->ft_sort_limit =
+        hints->get_limit();
+  }
+
+  return (ft_info);
 }
 
 /** Set up search tuple for a query through FTS_DOC_ID_INDEX on
@@ -9446,7 +9458,8 @@ int ha_innobase::ft_read(uchar *buf) /*!< in/out: buf contain result row */
       need to sort the document ids on their rank
       calculation. */
 
-      fts_query_sort_result_on_rank(result);
+      fts_query_sort_result_on_rank(
+          result, reinterpret_cast<NEW_FT_INFO *>(ft_handler)->ft_sort_limit);
 
       result->current =
           const_cast<ib_rbt_node_t *>(rbt_first(result->rankings_by_rank));
@@ -11476,6 +11489,38 @@ static ulint innobase_parse_merge_threshold(THD *thd, const char *str) {
   return (0);
 }
 
+/** Parse FILLFACTOR value from the string.
+@param[in]	thd	connection, or nullptr to suppress the warning
+@param[in]	str	string which might include 'FILLFACTOR='
+@return	value parsed, or DICT_INDEX_FILL_FACTOR_DEFAULT if not found
+or invalid */
+ulint innobase_parse_fill_factor(THD *thd, const char *str) {
+  static const char *label = "FILLFACTOR=";
+  static const size_t label_len = strlen(label);
+  const char *pos = strstr(str, label);
+
+  if (pos == NULL) {
+    return (DICT_INDEX_FILL_FACTOR_DEFAULT);
+  }
+
+  pos += label_len;
+
+  lint ret = atoi(pos);
+
+  if (ret >= 10 && ret <= 100) {
+    return (static_cast<ulint>(ret));
+  }
+
+  if (thd != NULL) {
+    push_warning_printf(
+        thd, Sql_condition::SL_WARNING, ER_ILLEGAL_HA_CREATE_OPTION,
+        "InnoDB: Invalid value for FILLFACTOR in the CREATE TABLE"
+        " statement. The value is ignored.");
+  }
+
+  return (DICT_INDEX_FILL_FACTOR_DEFAULT);
+}
+
 /** Parse hint for table and its indexes, and update the information
 in dictionary.
 @param[in]	thd		connection
@@ -11485,13 +11530,18 @@ void innobase_parse_hint_from_comment(THD *thd, dict_table_t *table,
                                       const TABLE_SHARE *table_share) {
   ulint merge_threshold_table;
   ulint merge_threshold_index[MAX_KEY];
+  ulint fill_factor_table;
+  ulint fill_factor_index[MAX_KEY];
   bool is_found[MAX_KEY];
 
   if (table_share->comment.str != NULL) {
     merge_threshold_table =
         innobase_parse_merge_threshold(thd, table_share->comment.str);
+    fill_factor_table =
+        innobase_parse_fill_factor(thd, table_share->comment.str);
   } else {
     merge_threshold_table = DICT_INDEX_MERGE_THRESHOLD_DEFAULT;
+    fill_factor_table = DICT_INDEX_FILL_FACTOR_DEFAULT;
   }
 
   if (merge_threshold_table == 0) {
@@ -11506,13 +11556,20 @@ void innobase_parse_hint_from_comment(THD *thd, dict_table_t *table,
     if (key_info->flags & HA_USES_COMMENT && key_info->comment.str != NULL) {
       merge_threshold_index[i] =
           innobase_parse_merge_threshold(thd, key_info->comment.str);
+      fill_factor_index[i] =
+          innobase_parse_fill_factor(thd, key_info->comment.str);
     } else {
       merge_threshold_index[i] = merge_threshold_table;
+      fill_factor_index[i] = fill_factor_table;
     }
 
     if (merge_threshold_index[i] == 0) {
       merge_threshold_index[i] = merge_threshold_table;
     }
+
+    if (fill_factor_index[i] == DICT_INDEX_FILL_FACTOR_DEFAULT) {
+      fill_factor_index[i] = fill_factor_table;
+    }
   }
 
   for (uint i = 0; i < table_share->keys; i++) {
@@ -11529,6 +11586,7 @@ void innobase_parse_hint_from_comment(THD *thd, dict_table_t *table,
       pessimistic tree operations */
       rw_lock_x_lock(dict_index_get_lock(index));
       index->merge_threshold = merge_threshold_table;
+      index->fill_factor = fill_factor_table;
       rw_lock_x_unlock(dict_index_get_lock(index));
 
       continue;
@@ -11546,6 +11604,7 @@ void innobase_parse_hint_from_comment(THD *thd, dict_table_t *table,
         pessimistic tree operations */
         rw_lock_x_lock(dict_index_get_lock(index));
         index->merge_threshold = merge_threshold_index[i];
+        index->fill_factor = fill_factor_index[i];
         rw_lock_x_unlock(dict_index_get_lock(index));
         is_found[i] = true;
 
@@ -19799,6 +19858,15 @@ static MYSQL_SYSVAR_ULONG(ft_sort_pll_degree, fts_sort_pll_degree,
                           "round up to nearest power of 2 number",
                           NULL, NULL, 2, 1, 16, 0);
 
+static MYSQL_SYSVAR_ULONG(index_build_threads, srv_index_build_threads,
+                          PLUGIN_VAR_RQCMDARG,
+                          "Maximum number of threads sorting and bulk loading "
+                          "secondary indexes in parallel during index creation "
+                          "or table rebuild. Each thread beyond the first "
+                          "allocates 3 * innodb_sort_buffer_size. The default "
+                          "1 builds the indexes one at a time",
+                          NULL, NULL, 1, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONG(sort_buffer_size, srv_sort_buf_size,
                           PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
                           "Memory buffer size for index creation", NULL, NULL,
@@ -20526,6 +20594,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(status_file),
     MYSQL_SYSVAR(strict_mode),
     MYSQL_SYSVAR(sort_buffer_size),
+    MYSQL_SYSVAR(index_build_threads),
     MYSQL_SYSVAR(online_alter_log_max_size),
     MYSQL_SYSVAR(directories),
     MYSQL_SYSVAR(sync_spin_loops),
@@ -21070,11 +21139,24 @@ bool ha_innobase::is_record_buffer_wanted(ha_rows *const max_rows) const {
     return false;
   }
 
-  /* Limit the number of rows in the buffer to 100 for now. We may want
-  to fine-tune this later, possibly taking record size and page size into
-  account. The optimizer might allocate an even smaller buffer if it
-  thinks a smaller number of rows will be fetched. */
-  *max_rows = 100;
+  /* Ask for room for about one leaf page worth of records, so that a
+  long scan fills the buffer while the page is latched and restores the
+  persistent cursor about once per page rather than every few rows. Use
+  at least 100 rows, and at most 1000, as a page holds no more than that
+  many records of any realistic width. The optimizer might allocate an
+  even smaller buffer if it thinks a smaller number of rows will be
+  fetched, and it limits the size of the buffer in bytes. */
+  static const ha_rows MIN_ROWS = 100;
+  static const ha_rows MAX_ROWS = 1000;
+
+  ha_rows rows_per_page = 0;
+  const dict_index_t *index = m_prebuilt->index;
+
+  if (index != nullptr && index->stat_n_leaf_pages > 0) {
+    rows_per_page = index->table->stat_n_rows / index->stat_n_leaf_pages;
+  }
+
+  *max_rows = std::min(std::max(rows_per_page, MIN_ROWS), MAX_ROWS);
   return true;
 }
 
@@ -640,6 +640,9 @@ typedef struct new_ft_info {
   struct _ft_vft_ext *could_you;
   row_prebuilt_t *ft_prebuilt;
   fts_result_t *ft_result;
+  /** Number of highest ranked rows that will be read, or
+  ULONG_UNDEFINED if all of them may be read */
+  ulonglong ft_sort_limit;
 } NEW_FT_INFO;
 
 /** Allocates an InnoDB transaction for a MySQL handler object for DML.
@@ -722,6 +725,13 @@ bool is_shared_tablespace(const char *tablespace_name) {
   return false;
 }
 
+/** Parse FILLFACTOR value from the string.
+@param[in]	thd	connection, or nullptr to suppress the warning
+@param[in]	str	string which might include 'FILLFACTOR='
+@return	value parsed, or DICT_INDEX_FILL_FACTOR_DEFAULT if not found
+or invalid */
+ulint innobase_parse_fill_factor(THD *thd, const char *str);
+
 /** Parse hint for table and its indexes, and update the information
 in dictionary.
 @param[in]	thd		Connection thread
@@ -113,7 +113,11 @@ enum class Instant_Type : uint16_t {
 
   /** ADD COLUMN which can be done instantly, including
   adding stored column only (or along with adding virtual columns) */
-  INSTANT_ADD_COLUMN
+  INSTANT_ADD_COLUMN,
+
+  /** Enlarge columns whose stored format does not change, like
+  VARCHAR(X) to VARCHAR(X + N) with the same number of length bytes */
+  INSTANT_ENLARGE_COLUMN
 };
 
 /** Function to convert the Instant_Type to a comparable int */
@@ -598,6 +602,14 @@ static inline Instant_Type innobase_support_instant(
     return (Instant_Type::INSTANT_VIRTUAL_ONLY);
   }
 
+  /* Enlarging a column with compatible packed representation only
+  changes the column length in metadata, existing records are read
+  the same way with either length. */
+  if (alter_inplace_flags ==
+      Alter_inplace_info::ALTER_COLUMN_EQUAL_PACK_LENGTH) {
+    return (Instant_Type::INSTANT_ENLARGE_COLUMN);
+  }
+
   if (!table->support_instant_add()) {
     return (Instant_Type::INSTANT_IMPOSSIBLE);
   }
@@ -750,6 +762,7 @@ enum_alter_inplace_result ha_innobase::check_if_supported_inplace_alter(
         /* Fall through */
       case Instant_Type::INSTANT_NO_CHANGE:
       case Instant_Type::INSTANT_VIRTUAL_ONLY:
+      case Instant_Type::INSTANT_ENLARGE_COLUMN:
         ha_alter_info->handler_trivial_ctx = instant_type_to_int(instant_type);
         DBUG_RETURN(HA_ALTER_INPLACE_INSTANT);
     }
@@ -2234,6 +2247,21 @@ static void innobase_create_index_def(const TABLE *altered_table,
   index->name = mem_heap_strdup(heap, key->name);
   index->rebuild = new_clustered;
 
+  /* The index may be bulk loaded before the hints are parsed at
+  commit by innobase_parse_hint_from_comment(), which is also where
+  any invalid value is reported. */
+  index->fill_factor = DICT_INDEX_FILL_FACTOR_DEFAULT;
+
+  if (key->flags & HA_USES_COMMENT && key->comment.str != nullptr) {
+    index->fill_factor = innobase_parse_fill_factor(nullptr, key->comment.str);
+  }
+
+  if (index->fill_factor == DICT_INDEX_FILL_FACTOR_DEFAULT &&
+      altered_table->s->comment.str != nullptr) {
+    index->fill_factor =
+        innobase_parse_fill_factor(nullptr, altered_table->s->comment.str);
+  }
+
   /* If this is a spatial index, we need to fetch the SRID */
   if (key->flags & HA_SPATIAL) {
     ulint dd_key_num =
@@ -2647,6 +2675,11 @@ index for FTS index */
       index->rebuild = true;
       index->key_number = ~0;
       index->is_ngram = false;
+      index->fill_factor =
+          altered_table->s->comment.str != nullptr
+              ? innobase_parse_fill_factor(nullptr,
+                                           altered_table->s->comment.str)
+              : DICT_INDEX_FILL_FACTOR_DEFAULT;
       primary_key_number = ULINT_UNDEFINED;
       goto created_clustered;
     } else {
@@ -2736,6 +2769,7 @@ index for FTS index */
 
     index->name = FTS_DOC_ID_INDEX_NAME;
     index->is_ngram = false;
+    index->fill_factor = DICT_INDEX_FILL_FACTOR_DEFAULT;
     index->rebuild = rebuild;
 
     /* TODO: assign a real MySQL key number for this */
@@ -3934,6 +3968,16 @@ static void dd_commit_inplace_instant(Alter_inplace_info *ha_alter_info,
                                reinterpret_cast<dd::Partition *>(new_dd_tab));
       }
 
+      row_mysql_lock_data_dictionary(trx);
+      innobase_discard_table(thd, table);
+      row_mysql_unlock_data_dictionary(trx);
+      break;
+    case Instant_Type::INSTANT_ENLARGE_COLUMN:
+      dd_commit_inplace_no_change(old_dd_tab, new_dd_tab, false);
+
+      /* Reload the table from the new metadata, instead of patching
+      column lengths in the cache, so that any virtual column template
+      built on the old MySQL record layout is rebuilt too. */
       row_mysql_lock_data_dictionary(trx);
       innobase_discard_table(thd, table);
       row_mysql_unlock_data_dictionary(trx);
@@ -9580,6 +9624,7 @@ enum_alter_inplace_result ha_innopart::check_if_supported_inplace_alter(
       /* Fall through */
     case Instant_Type::INSTANT_NO_CHANGE:
     case Instant_Type::INSTANT_VIRTUAL_ONLY:
+    case Instant_Type::INSTANT_ENLARGE_COLUMN:
       ha_alter_info->handler_trivial_ctx = instant_type_to_int(instant_type);
       DBUG_RETURN(HA_ALTER_INPLACE_INSTANT);
   }
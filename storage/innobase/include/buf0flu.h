@@ -195,6 +195,35 @@ void buf_flush_page_cleaner_init(size_t n_page_cleaners);
 /** Wait for any possible LRU flushes that are in progress to end. */
 void buf_flush_wait_LRU_batch_end();
 
+/** State kept by buf_flush_steer_n_pages() between page cleaner
+iterations. */
+struct buf_flush_steer_t {
+  /** Number of pages returned by the previous iteration */
+  ulint prev_n_pages;
+  /** Checkpoint age seen by the previous iteration */
+  lsn_t prev_age;
+};
+
+/** Steers the number of pages to flush towards the raw recommendation of
+the adaptive flushing heuristics. The target moves by a fraction of the
+gap, faster upwards while the checkpoint age keeps growing and slower
+downwards while it does, and it is bounded by the number of pages the page
+cleaners were measured to be able to write in one iteration. Once redo
+space runs short the raw recommendation is followed without delay.
+@param[in,out]	steer		state kept between iterations
+@param[in]	n_pages		raw number of pages recommended
+@param[in]	pct_for_lsn	percent of io_capacity requested for redo age
+@param[in]	age		current checkpoint age
+@param[in]	us_per_page	measured time for one page cleaner to write one
+                                page from the flush_list, in microseconds,
+                                or 0 if not measured yet
+@param[in]	n_cleaners	number of page cleaner threads
+@param[in]	io_capacity	innodb_io_capacity
+@return number of pages to flush in this iteration */
+ulint buf_flush_steer_n_pages(buf_flush_steer_t *steer, ulint n_pages,
+                              ulint pct_for_lsn, lsn_t age, ulint us_per_page,
+                              ulint n_cleaners, ulint io_capacity);
+
 #if defined UNIV_DEBUG || defined UNIV_BUF_DEBUG
 /** Validates the flush list.
  @return true if ok */
@@ -82,9 +82,6 @@ struct Less_Clone_Page {
 /** Vector type for storing clone page IDs */
 using Clone_Page_Vec = std::vector<Clone_Page>;
 
-/** Set for storing unique page IDs. */
-using Clone_Page_Set = std::set<Clone_Page, Less_Clone_Page>;
-
 /** Clone handle type */
 enum Clone_Handle_Type {
   /** Clone Handle for COPY */
@@ -457,10 +454,8 @@ class Clone_Snapshot {
   /** Page archiver client */
   Page_Arch_Client_Ctx m_page_ctx;
 
-  /** Set of unique page IDs */
-  Clone_Page_Set m_page_set;
-
-  /** Sorted page IDs to transfer */
+  /** Sorted page IDs to transfer. Page IDs are appended as they are
+  tracked and sorted and made unique in init_page_copy(). */
   Clone_Page_Vec m_page_vector;
 
   /** Number of pages to transfer */
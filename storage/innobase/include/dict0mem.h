@@ -877,6 +877,12 @@ struct dict_index_t {
   data size drops below this limit in percent,
   merging it to a neighbor is tried */
 #define DICT_INDEX_MERGE_THRESHOLD_DEFAULT 50
+  unsigned fill_factor : 7;
+  /*!< Percentage of each page filled by
+  bulk load of this index, or
+  DICT_INDEX_FILL_FACTOR_DEFAULT to use the
+  global innodb_fill_factor */
+#define DICT_INDEX_FILL_FACTOR_DEFAULT 0
   unsigned type : DICT_IT_BITS;
   /*!< index type (DICT_CLUSTERED, DICT_UNIQUE,
   DICT_IBUF, DICT_CORRUPT) */
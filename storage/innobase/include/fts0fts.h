@@ -610,8 +610,11 @@ float fts_retrieve_ranking(
 
 /** FTS Query sort result, returned by fts_query() on fts_ranking_t::rank. */
 void fts_query_sort_result_on_rank(
-    fts_result_t *result); /*!< out: result instance
-                           to sort.*/
+    fts_result_t *result, /*!< out: result instance
+                          to sort.*/
+    ulonglong limit);     /*!< in: number of highest ranked
+                          documents to keep, or
+                          ULONG_UNDEFINED to keep all */
 
 /** FTS Query free result, returned by fts_query(). */
 void fts_query_free_result(fts_result_t *result); /*!< in: result instance
@@ -121,6 +121,8 @@ struct index_def_t {
   bool srid_is_valid;        /*!< true if we want to check SRID
                              while inserting to index */
   uint32_t srid;             /*!< SRID obtained from dd column */
+  ulint fill_factor;         /*!< FILLFACTOR from the index comment,
+                             or DICT_INDEX_FILL_FACTOR_DEFAULT */
 };
 
 /** Structure for reporting duplicate records. */
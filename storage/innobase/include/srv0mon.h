@@ -386,6 +386,11 @@ enum monitor_id_t {
   MONITOR_PAGE_DECOMPRESS,
   MONITOR_PAD_INCREMENTS,
   MONITOR_PAD_DECREMENTS,
+  MONITOR_TRANSPARENT_COMPRESS,
+  MONITOR_TRANSPARENT_DECOMPRESS,
+  MONITOR_TRANSPARENT_BYTES_SAVED,
+  MONITOR_TRANSPARENT_COMPRESS_TIME,
+  MONITOR_TRANSPARENT_DECOMPRESS_TIME,
 
   /* Index related counters */
   MONITOR_MODULE_INDEX,
@@ -640,6 +645,23 @@ Use MONITOR_INC if appropriate mutex protection exists.
     }                                                                          \
   }
 
+/** Atomically add a value to a monitor counter.
+Use MONITOR_INC_VALUE if appropriate mutex protection exists.
+@param monitor monitor to be incremented
+@param value value to add to the monitor counter */
+#define MONITOR_ATOMIC_INC_VALUE(monitor, value)                       \
+  MONITOR_CHECK_DEFINED(value);                                        \
+  if (MONITOR_IS_ON(monitor)) {                                        \
+    ib_uint64_t new_value;                                             \
+    new_value = os_atomic_increment_uint64(                            \
+        (ib_uint64_t *)&MONITOR_VALUE(monitor), (ib_uint64_t)(value)); \
+    /* Note: This is not 100% accurate because of the                  \
+    inherent race, we ignore it due to performance. */                 \
+    if (new_value > (ib_uint64_t)MONITOR_MAX_VALUE(monitor)) {         \
+      MONITOR_MAX_VALUE(monitor) = new_value;                          \
+    }                                                                  \
+  }
+
 /** Atomically decrement a monitor counter.
 Use MONITOR_DEC if appropriate mutex protection exists.
 @param monitor monitor to be decremented by 1 */
@@ -735,6 +757,20 @@ monitor counter
     MONITOR_VALUE(monitor) += (mon_type_t)(value - old_time); \
   }
 
+/** Atomically add time difference between now and input "value" (in
+microseconds) to the monitor counter.
+Use MONITOR_INC_TIME_IN_MICRO_SECS if appropriate mutex protection exists.
+@param monitor monitor to update for the time difference
+@param value the start time value */
+#define MONITOR_ATOMIC_INC_TIME_IN_MICRO_SECS(monitor, value)          \
+  MONITOR_CHECK_DEFINED(value);                                        \
+  if (MONITOR_IS_ON(monitor)) {                                        \
+    uintmax_t old_time = (value);                                      \
+    value = ut_time_us(NULL);                                          \
+    os_atomic_increment_uint64((ib_uint64_t *)&MONITOR_VALUE(monitor), \
+                               (ib_uint64_t)(value - old_time));       \
+  }
+
 /** This macro updates 3 counters in one call. However, it only checks the
 main/first monitor counter 'monitor', to see it is on or off to decide
 whether to do the update.
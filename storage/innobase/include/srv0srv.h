@@ -213,6 +213,10 @@ extern bool srv_buffer_pool_load_at_startup;
 /* Whether to disable file system cache if it is defined */
 extern bool srv_disable_sort_file_cache;
 
+/** Maximum number of threads sorting and bulk loading indexes in parallel
+while building them in row_merge_build_indexes() */
+extern ulong srv_index_build_threads;
+
 /* If the last data file is auto-extended, we add this many pages to it
 at a time */
 #define SRV_AUTO_EXTEND_INCREMENT (srv_sys_space.get_autoextend_increment())
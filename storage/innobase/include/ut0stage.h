@@ -35,6 +35,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 
 #include <math.h>
 #include <algorithm>
+#include <atomic>
 
 #include "dict0mem.h"              /* dict_index_t */
 #include "mysql/psi/mysql_stage.h" /* mysql_stage_inc_work_completed */
@@ -85,6 +86,7 @@ class ut_stage_alter_t {
         m_n_pk_pages(0),
         m_n_recs_processed(0),
         m_n_flush_pages(0),
+        m_n_helper_indexes(0),
         m_cur_phase(NOT_STARTED) {}
 
   /** Destructor. */
@@ -135,6 +137,17 @@ class ut_stage_alter_t {
   /** Flag the beginning of the end phase. */
   void begin_phase_end();
 
+  /** Flag one index sorted and inserted by a helper thread. The helper
+  has no performance schema instrumentation of its own, so this only
+  records the work; it is reported by the next call to
+  report_helper_work() from the thread that owns this object.
+  May be called from any thread. */
+  void helper_index_done();
+
+  /** Report the work recorded by helper_index_done() since the last
+  call. Must be called from the thread that owns this object. */
+  void report_helper_work();
+
  private:
   /** Update the estimate of total work to be done. */
   void reestimate();
@@ -175,6 +188,10 @@ class ut_stage_alter_t {
   /** Number of pages to flush. */
   ulint m_n_flush_pages;
 
+  /** Number of indexes completed by helper threads and not reported
+  yet. */
+  std::atomic<ulint> m_n_helper_indexes;
+
   /** Current phase. */
   enum {
     NOT_STARTED = 0,
@@ -287,6 +304,24 @@ inline void ut_stage_alter_t::inc(ulint inc_val /* = 1 */) {
   }
 }
 
+/** Flag one index sorted and inserted by a helper thread. */
+inline void ut_stage_alter_t::helper_index_done() { m_n_helper_indexes++; }
+
+/** Report the work recorded by helper_index_done() since the last call. */
+inline void ut_stage_alter_t::report_helper_work() {
+  const ulint n_indexes = m_n_helper_indexes.exchange(0);
+
+  if (m_progress == NULL || n_indexes == 0) {
+    return;
+  }
+
+  /* reestimate() accounts the sort and the insert of each index as
+  one pass over the leaf pages of the primary key each. */
+  mysql_stage_inc_work_completed(m_progress, n_indexes * 2 * m_n_pk_pages);
+
+  reestimate();
+}
+
 /** Flag the end of reading of the primary key.
 Here we know the exact number of pages and records and calculate
 the number of records per page and refresh the estimate. */
@@ -536,6 +571,10 @@ class ut_stage_alter_t {
   void begin_phase_log_table() {}
 
   void begin_phase_end() {}
+
+  void helper_index_done() {}
+
+  void report_helper_work() {}
 };
 
 class ut_stage_alter_ts {
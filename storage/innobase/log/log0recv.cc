@@ -36,6 +36,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <my_aes.h>
 #include <sys/types.h>
 
+#include <algorithm>
 #include <array>
 #include <iomanip>
 #include <map>
@@ -1252,14 +1253,30 @@ void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
       dropped = false;
     }
 
-    for (auto pages : space.second.m_pages) {
+    /* The page hash is unordered. Apply the pages in ascending page
+    number order so that recv_read_in_area() submits each read-ahead area
+    once, and the reads are sequential within the tablespace. */
+    std::vector<recv_addr_t *> recv_addrs;
+
+    recv_addrs.reserve(space.second.m_pages.size());
+
+    for (const auto &pages : space.second.m_pages) {
       ut_ad(pages.second->space == space.first);
 
+      recv_addrs.push_back(pages.second);
+    }
+
+    std::sort(recv_addrs.begin(), recv_addrs.end(),
+              [](const recv_addr_t *lhs, const recv_addr_t *rhs) {
+                return (lhs->page_no < rhs->page_no);
+              });
+
+    for (auto recv_addr : recv_addrs) {
       if (dropped) {
-        pages.second->state = RECV_DISCARDED;
+        recv_addr->state = RECV_DISCARDED;
       }
 
-      recv_apply_log_rec(pages.second);
+      recv_apply_log_rec(recv_addr);
 
       ++applied;
 
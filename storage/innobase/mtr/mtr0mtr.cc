@@ -358,7 +358,10 @@ bool mtr_t::is_block_dirtied(const buf_block_t *block) {
 #ifndef UNIV_HOTBACKUP
 /** Write the block contents to the REDO log */
 struct mtr_write_log_t {
-  /** Append a block to the redo log buffer.
+  /** Append a block to the redo log buffer. The caller reports the
+  whole range as written with log_buffer_write_completed() after the last
+  block, so the recent_written links are updated once per mini-transaction
+  rather than once per block.
   @return whether the appending should continue */
   bool operator()(const mtr_buf_t::block_t *block) {
     lsn_t start_lsn;
@@ -403,8 +406,6 @@ struct mtr_write_log_t {
       log_buffer_set_first_record_group(*log_sys, m_handle, end_lsn);
     }
 
-    log_buffer_write_completed(*log_sys, m_handle, start_lsn, end_lsn);
-
     m_lsn = end_lsn;
 
     return (true);
@@ -648,6 +649,12 @@ void mtr_t::Command::execute() {
     ut_ad(write_log.m_left_to_write == 0);
     ut_ad(write_log.m_lsn == handle.end_lsn);
 
+    /* The whole group fits in the log buffer (log_buffer_reserve()
+    has waited for space for it), so one link covering all the blocks
+    is enough for the log writer. */
+    log_buffer_write_completed(*log_sys, handle, handle.start_lsn,
+                               handle.end_lsn);
+
     log_wait_for_space_in_log_recent_closed(*log_sys, handle.start_lsn);
 
     DEBUG_SYNC_C("mtr_redo_before_add_dirty_blocks");
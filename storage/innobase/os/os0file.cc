@@ -1370,6 +1370,9 @@ static byte *os_file_compress_page(Compression compression, ulint block_size,
   ut_ad(out_len >= block_size - FIL_PAGE_DATA);
   ut_ad(out_len <= src_len - (block_size + FIL_PAGE_DATA));
 
+  uintmax_t start_time = ut_time_us(NULL);
+  bool compressed = false;
+
   /* Only compress the data + trailer, leave the header alone */
 
   switch (compression.m_type) {
@@ -1381,14 +1384,12 @@ static byte *os_file_compress_page(Compression compression, ulint block_size,
 
       if (compress2(dst + FIL_PAGE_DATA, &zlen, src + FIL_PAGE_DATA,
                     static_cast<uLong>(content_len),
-                    static_cast<int>(compression_level)) != Z_OK) {
-        *dst_len = src_len;
+                    static_cast<int>(compression_level)) == Z_OK) {
+        len = static_cast<ulint>(zlen);
 
-        return (src);
+        compressed = true;
       }
 
-      len = static_cast<ulint>(zlen);
-
       break;
     }
 
@@ -1401,21 +1402,28 @@ static byte *os_file_compress_page(Compression compression, ulint block_size,
 
       ut_a(len <= src_len - FIL_PAGE_DATA);
 
-      if (len == 0 || len >= out_len) {
-        *dst_len = src_len;
-
-        return (src);
-      }
+      compressed = len > 0 && len < out_len;
 
       break;
 
     default:
-      *dst_len = src_len;
-      return (src);
+      break;
+  }
+
+  /* Failed and unprofitable attempts cost CPU time too. */
+  MONITOR_ATOMIC_INC_TIME_IN_MICRO_SECS(MONITOR_TRANSPARENT_COMPRESS_TIME,
+                                        start_time);
+
+  if (!compressed) {
+    *dst_len = src_len;
+
+    return (src);
   }
 
   ut_a(len <= out_len);
 
+  MONITOR_ATOMIC_INC(MONITOR_TRANSPARENT_COMPRESS);
+
   ut_ad(memcmp(src + FIL_PAGE_LSN + 4,
                src + src_len - FIL_PAGE_END_LSN_OLD_CHKSUM + 4, 4) == 0);
 
@@ -1678,8 +1686,18 @@ static dberr_t os_file_io_complete(const IORequest &type, os_file_t fh,
 
     ret = encryption.decrypt(type, buf, src_len, scratch, len);
     if (ret == DB_SUCCESS) {
-      return (
-          os_file_decompress_page(type.is_dblwr_recover(), buf, scratch, len));
+      const bool compressed = Compression::is_compressed_page(buf);
+      uintmax_t start_time = ut_time_us(NULL);
+
+      ret = os_file_decompress_page(type.is_dblwr_recover(), buf, scratch, len);
+
+      if (compressed && ret == DB_SUCCESS) {
+        MONITOR_ATOMIC_INC(MONITOR_TRANSPARENT_DECOMPRESS);
+        MONITOR_ATOMIC_INC_TIME_IN_MICRO_SECS(
+            MONITOR_TRANSPARENT_DECOMPRESS_TIME, start_time);
+      }
+
+      return (ret);
     } else {
       return (ret);
     }
@@ -1710,7 +1728,14 @@ static dberr_t os_file_io_complete(const IORequest &type, os_file_t fh,
 
     offset += len;
 
-    return (os_file_punch_hole(fh, offset, src_len - len));
+    ret = os_file_punch_hole(fh, offset, src_len - len);
+
+    /* Space is only saved if the hole was punched. */
+    if (ret == DB_SUCCESS) {
+      MONITOR_ATOMIC_INC_VALUE(MONITOR_TRANSPARENT_BYTES_SAVED, src_len - len);
+    }
+
+    return (ret);
   }
 
   ut_ad(!type.is_log());
@@ -34,6 +34,9 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <fcntl.h>
 #include <math.h>
 #include <sys/types.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include <sql_class.h>
 #include "btr0bulk.h"
@@ -44,6 +47,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "lob0lob.h"
 #include "lock0lock.h"
 #include "my_psi_config.h"
+#include "os0thread-create.h"
 #include "pars0pars.h"
 #include "row0ext.h"
 #include "row0ftsort.h"
@@ -67,6 +71,10 @@ this program; if not, write to the Free Software Foundation, Inc.,
 /* Whether to disable file system cache */
 bool srv_disable_sort_file_cache;
 
+/** Maximum number of threads sorting and bulk loading indexes in parallel
+while building them in row_merge_build_indexes() */
+ulong srv_index_build_threads = 1;
+
 /** Class that caches index row tuples made from a single cluster
 index page scan, and then insert into corresponding index tree */
 class index_tuple_info_t {
@@ -3413,6 +3421,7 @@ dict_index_t *row_merge_create_index(trx_t *trx, dict_table_t *table,
 
   index->parser = index_def->parser;
   index->is_ngram = index_def->is_ngram;
+  index->fill_factor = index_def->fill_factor;
   index->has_new_v_col = has_new_v_col;
 
   /* Note the id of the transaction that created this
@@ -3459,6 +3468,195 @@ static void row_merge_write_redo(const dict_index_t *index) {
   mtr.commit();
 }
 
+/** Sort the entries of one index and bulk load them into the index tree.
+@param[in]	trx		transaction
+@param[in]	index		index to be built
+@param[in]	old_table	old table
+@param[in,out]	table		MySQL table, for reporting duplicates
+@param[in]	col_map		mapping of old column numbers to new ones, or
+                                NULL if old_table == new_table
+@param[in,out]	merge_file	file containing the index entries; it is
+                                closed when done
+@param[in,out]	block		3 buffers
+@param[in,out]	tmpfd		temporary file handle
+@param[in]	flush_observer	flush observer of the bulk load
+@param[in,out]	stage		performance schema accounting object, or NULL
+@return DB_SUCCESS or error code */
+static dberr_t row_merge_sort_and_load(
+    trx_t *trx, dict_index_t *index, const dict_table_t *old_table,
+    struct TABLE *table, const ulint *col_map, merge_file_t *merge_file,
+    row_merge_block_t *block, int *tmpfd, FlushObserver *flush_observer,
+    ut_stage_alter_t *stage) {
+  row_merge_dup_t dup = {index, table, col_map, 0};
+
+  dberr_t error = row_merge_sort(trx, &dup, merge_file, block, tmpfd, stage);
+
+  if (error == DB_SUCCESS) {
+    BtrBulk btr_bulk(index, trx->id, flush_observer);
+    error = btr_bulk.init();
+    if (error == DB_SUCCESS) {
+      error = row_merge_insert_index_tuples(trx, index, old_table,
+                                            merge_file->fd, block, NULL,
+                                            &btr_bulk, stage);
+
+      error = btr_bulk.finish(error);
+    }
+  }
+
+  /* Close the temporary file to free up space. */
+  row_merge_file_destroy(merge_file);
+
+  return (error);
+}
+
+/** Sort and bulk load several secondary indexes at the same time, each of
+them by one thread. Only non-unique indexes are built here: reporting a
+duplicate key converts the entry into the MySQL record buffer of the table,
+which is shared by all the threads. The calling thread takes part in the
+work and reports the progress of the helpers to performance schema, as
+they are not instrumented. The DBUG settings of the calling thread are
+copied to the helpers, so that error injection reaches them too.
+@param[in]	trx		transaction
+@param[in]	old_table	old table
+@param[in]	indexes		indexes to be created
+@param[in]	n_indexes	size of indexes[]
+@param[in,out]	table		MySQL table
+@param[in]	col_map		mapping of old column numbers to new ones, or
+                                NULL if old_table == new_table
+@param[in,out]	merge_files	files containing the index entries
+@param[in,out]	block		3 buffers of the calling thread
+@param[in,out]	tmpfd		temporary file handle of the calling thread
+@param[in]	flush_observer	flush observer of the bulk load
+@param[in,out]	stage		performance schema accounting object, or NULL
+@param[out]	errors		outcome for each index built here, left as
+                                DB_ERROR_UNSET for the other indexes */
+static void row_merge_build_indexes_parallel(
+    trx_t *trx, const dict_table_t *old_table, dict_index_t **indexes,
+    ulint n_indexes, struct TABLE *table, const ulint *col_map,
+    merge_file_t *merge_files, row_merge_block_t *block, int *tmpfd,
+    FlushObserver *flush_observer, ut_stage_alter_t *stage,
+    std::vector<dberr_t> &errors) {
+  std::vector<ulint> tasks;
+
+  for (ulint i = 0; i < n_indexes; i++) {
+    const dict_index_t *index = indexes[i];
+
+    if (merge_files[i].fd >= 0 && !index->is_clustered() &&
+        !dict_index_is_unique(index) && !dict_index_is_spatial(index) &&
+        !(index->type & DICT_FTS)) {
+      tasks.push_back(i);
+    }
+  }
+
+  ulint n_threads = std::min<ulint>(srv_index_build_threads, tasks.size());
+
+  if (n_threads < 2) {
+    return;
+  }
+
+  const char *path = thd_innodb_tmpdir(trx->mysql_thd);
+  std::atomic<size_t> next_task{0};
+  std::atomic<bool> failed{false};
+  std::atomic<ulint> n_running{0};
+
+#ifndef DBUG_OFF
+  char dbug_state[256];
+  DBUG_EXPLAIN(dbug_state, sizeof(dbug_state));
+#endif /* !DBUG_OFF */
+
+  auto build = [&](row_merge_block_t *thr_block, int *thr_tmpfd,
+                   bool is_helper) {
+    for (;;) {
+      size_t task = next_task.fetch_add(1);
+
+      if (task >= tasks.size() || failed.load()) {
+        break;
+      }
+
+      ulint i = tasks[task];
+
+      /* Only the calling thread may change the stage, the helpers
+      report their work once per index. */
+      errors[i] = row_merge_sort_and_load(
+          trx, indexes[i], old_table, table, col_map, &merge_files[i],
+          thr_block, thr_tmpfd, flush_observer, is_helper ? nullptr : stage);
+
+      if (errors[i] != DB_SUCCESS) {
+        failed.store(true);
+      } else if (stage != NULL) {
+        if (is_helper) {
+          stage->helper_index_done();
+        } else {
+          stage->report_helper_work();
+        }
+      }
+    }
+  };
+
+  /* Each helper thread needs its own sort buffers and temporary file. */
+  auto helper = [&](row_merge_block_t *thr_block) {
+#ifndef DBUG_OFF
+    DBUG_SET(dbug_state);
+#endif /* !DBUG_OFF */
+
+    int thr_tmpfd = row_merge_file_create_low(path);
+
+    /* If there is no temporary file, leave the work to the other
+    threads. */
+    if (thr_tmpfd >= 0) {
+      build(thr_block, &thr_tmpfd, true);
+
+      row_merge_file_destroy_low(thr_tmpfd);
+    }
+
+    n_running.fetch_sub(1);
+  };
+
+  ut_allocator<row_merge_block_t> alloc(mem_key_row_merge_sort);
+  std::vector<ut_new_pfx_t> block_pfx(n_threads - 1);
+  std::vector<row_merge_block_t *> blocks;
+  std::vector<std::thread> workers;
+
+  for (ulint i = 0; i + 1 < n_threads; i++) {
+    row_merge_block_t *thr_block =
+        alloc.allocate_large(3 * srv_sort_buf_size, &block_pfx[i]);
+
+    if (thr_block == NULL) {
+      break;
+    }
+
+    blocks.push_back(thr_block);
+
+    n_running.fetch_add(1);
+
+    workers.push_back(
+        std::thread{Runnable{PFS_NOT_INSTRUMENTED}, helper, thr_block});
+  }
+
+  build(block, tmpfd, false);
+
+  /* Keep reporting the progress until the helpers are done. */
+  if (stage != NULL) {
+    while (n_running.load() > 0) {
+      stage->report_helper_work();
+
+      os_thread_sleep(100000);
+    }
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  if (stage != NULL) {
+    stage->report_helper_work();
+  }
+
+  for (ulint i = 0; i < blocks.size(); i++) {
+    alloc.deallocate_large(blocks[i], &block_pfx[i]);
+  }
+}
+
 /** Build indexes on a table by reading a clustered index, creating a temporary
 file containing index entries, merge sorting these index entries and inserting
 sorted index entries to indexes.
@@ -3506,6 +3704,7 @@ dberr_t row_merge_build_indexes(
   fts_psort_t *merge_info = NULL;
   int64_t sig_count = 0;
   bool fts_psort_initiated = false;
+  std::vector<dberr_t> parallel_errors(n_indexes, DB_ERROR_UNSET);
   DBUG_ENTER("row_merge_build_indexes");
 
   ut_ad(!srv_read_only_mode);
@@ -3621,6 +3820,10 @@ dberr_t row_merge_build_indexes(
   /* Now we have files containing index entries ready for
   sorting and inserting. */
 
+  row_merge_build_indexes_parallel(trx, old_table, indexes, n_indexes, table,
+                                   col_map, merge_files, block, &tmpfd,
+                                   flush_observer, stage, parallel_errors);
+
   for (i = 0; i < n_indexes; i++) {
     dict_index_t *sort_idx = indexes[i];
 
@@ -3628,7 +3831,9 @@ dberr_t row_merge_build_indexes(
       continue;
     }
 
-    if (indexes[i]->type & DICT_FTS) {
+    if (parallel_errors[i] != DB_ERROR_UNSET) {
+      error = parallel_errors[i];
+    } else if (indexes[i]->type & DICT_FTS) {
       os_event_t fts_parallel_merge_event;
 
       sort_idx = fts_sort_idx;
@@ -3684,21 +3889,9 @@ dberr_t row_merge_build_indexes(
       DEBUG_FTS_SORT_PRINT("FTS_SORT: Complete Insert\n");
 #endif
     } else if (merge_files[i].fd >= 0) {
-      row_merge_dup_t dup = {sort_idx, table, col_map, 0};
-
-      error = row_merge_sort(trx, &dup, &merge_files[i], block, &tmpfd, stage);
-
-      if (error == DB_SUCCESS) {
-        BtrBulk btr_bulk(sort_idx, trx->id, flush_observer);
-        error = btr_bulk.init();
-        if (error == DB_SUCCESS) {
-          error = row_merge_insert_index_tuples(trx, sort_idx, old_table,
-                                                merge_files[i].fd, block, NULL,
-                                                &btr_bulk, stage);
-
-          error = btr_bulk.finish(error);
-        }
-      }
+      error = row_merge_sort_and_load(trx, sort_idx, old_table, table, col_map,
+                                      &merge_files[i], block, &tmpfd,
+                                      flush_observer, stage);
     }
 
     /* Close the temporary file to free up space. */
@@ -970,6 +970,27 @@ static monitor_info_t innodb_counter_info[] = {
      "Number of times padding is decremented due to good compressibility",
      MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_PAD_DECREMENTS},
 
+    {"compress_transparent_pages_compressed", "compression",
+     "Number of pages compressed by transparent page compression on write",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_TRANSPARENT_COMPRESS},
+
+    {"compress_transparent_pages_decompressed", "compression",
+     "Number of pages decompressed by transparent page compression on read",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_TRANSPARENT_DECOMPRESS},
+
+    {"compress_transparent_bytes_saved", "compression",
+     "Bytes freed by punching holes after transparent page compression",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_TRANSPARENT_BYTES_SAVED},
+
+    {"compress_transparent_compress_time", "compression",
+     "Time (in micro-seconds) spent compressing pages on write, including"
+     " attempts that did not save space",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_TRANSPARENT_COMPRESS_TIME},
+
+    {"compress_transparent_decompress_time", "compression",
+     "Time (in micro-seconds) spent decompressing pages on read",
+     MONITOR_NONE, MONITOR_DEFAULT_START, MONITOR_TRANSPARENT_DECOMPRESS_TIME},
+
     /* ========== Counters for Index ========== */
     {"module_index", "index", "Index Manager", MONITOR_MODULE,
      MONITOR_DEFAULT_START, MONITOR_MODULE_INDEX},
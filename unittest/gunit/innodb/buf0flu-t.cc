@@ -0,0 +1,94 @@
+/* Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/* See http://code.google.com/p/googletest/wiki/Primer */
+
+// First include (the generated) my_config.h, to get correct platform defines.
+#include "my_config.h"
+
+#include <gtest/gtest.h>
+
+#include "storage/innobase/include/univ.i"
+
+#include "storage/innobase/include/buf0flu.h"
+
+namespace innodb_buf0flu_unittest {
+
+/* Steering of the adaptive flushing target. */
+
+TEST(buf0flu, steer_moves_by_fraction_of_gap) {
+  buf_flush_steer_t steer = {0, 0};
+
+  /* Upwards while the age grows: half of the gap. */
+  EXPECT_EQ(50U, buf_flush_steer_n_pages(&steer, 100, 10, 1000, 0, 1, 200));
+  /* Upwards while the age does not grow: a quarter of the gap. */
+  EXPECT_EQ(63U, buf_flush_steer_n_pages(&steer, 100, 10, 1000, 0, 1, 200));
+  /* Downwards while the age grows: an eighth of the gap. */
+  EXPECT_EQ(55U, buf_flush_steer_n_pages(&steer, 0, 10, 2000, 0, 1, 200));
+  /* Downwards while the age does not grow: half of the gap. */
+  EXPECT_EQ(27U, buf_flush_steer_n_pages(&steer, 0, 10, 2000, 0, 1, 200));
+}
+
+TEST(buf0flu, steer_converges) {
+  buf_flush_steer_t steer = {0, 0};
+  ulint n_pages = 0;
+
+  for (int i = 0; i < 50; ++i) {
+    n_pages = buf_flush_steer_n_pages(&steer, 1000, 10, 1000, 0, 1, 200);
+  }
+  EXPECT_EQ(1000U, n_pages);
+
+  for (int i = 0; i < 50; ++i) {
+    n_pages = buf_flush_steer_n_pages(&steer, 10, 10, 1000, 0, 1, 200);
+  }
+  EXPECT_EQ(10U, n_pages);
+}
+
+TEST(buf0flu, steer_follows_raw_target_when_redo_is_short) {
+  buf_flush_steer_t steer = {0, 0};
+
+  EXPECT_EQ(500U, buf_flush_steer_n_pages(&steer, 500, 100, 1000, 0, 1, 200));
+  /* The target must also drop at once, not only rise. */
+  EXPECT_EQ(10U, buf_flush_steer_n_pages(&steer, 10, 100, 2000, 0, 1, 200));
+  EXPECT_EQ(700U, buf_flush_steer_n_pages(&steer, 700, 150, 3000, 0, 1, 200));
+  EXPECT_EQ(0U, buf_flush_steer_n_pages(&steer, 0, 150, 4000, 0, 1, 200));
+}
+
+TEST(buf0flu, steer_bounded_by_measured_capacity) {
+  buf_flush_steer_t steer = {0, 0};
+
+  /* One cleaner writing one page per millisecond: 1000 pages. */
+  EXPECT_EQ(1000U,
+            buf_flush_steer_n_pages(&steer, 5000, 10, 1000, 1000, 1, 200));
+  /* Two cleaners double the capacity. */
+  EXPECT_EQ(2000U,
+            buf_flush_steer_n_pages(&steer, 5000, 10, 2000, 1000, 2, 200));
+  /* Never bounded below innodb_io_capacity. */
+  steer = {0, 0};
+  EXPECT_EQ(2500U,
+            buf_flush_steer_n_pages(&steer, 5000, 10, 1000, 10000, 1, 3000));
+  /* Not bounded when redo space runs short. */
+  EXPECT_EQ(5000U,
+            buf_flush_steer_n_pages(&steer, 5000, 100, 2000, 1000, 1, 200));
+}
+
+}  // namespace innodb_buf0flu_unittest
@@ -453,6 +453,21 @@ void vet_wrapper_length(const THD *thd, const char *text,
       << "Wrapped BINARY: " << text << "\n";
 }
 
+void vet_wrapper_depth(const THD *thd, const char *text,
+                       uint32 expected_depth) {
+  Json_wrapper dom_wrapper(parse_json(text));
+  EXPECT_EQ(expected_depth, dom_wrapper.depth())
+      << "Wrapped DOM: " << text << "\n";
+
+  String serialized_form;
+  EXPECT_FALSE(
+      json_binary::serialize(thd, dom_wrapper.to_dom(thd), &serialized_form));
+  Json_wrapper binary_wrapper(json_binary::parse_binary(
+      serialized_form.ptr(), serialized_form.length()));
+  EXPECT_EQ(expected_depth, binary_wrapper.depth())
+      << "Wrapped BINARY: " << text << "\n";
+}
+
 TEST_F(JsonDomTest, WrapperTest) {
   // Constructors, assignment, copy constructors, aliasing
   Json_dom *d = new (std::nothrow) Json_null();
@@ -483,6 +498,7 @@ TEST_F(JsonDomTest, WrapperTest) {
   EXPECT_EQ(nullptr, w_6.to_dom(thd));
   EXPECT_EQ(nullptr, w_6.clone_dom(thd));
   EXPECT_EQ(0U, w_6.length());
+  EXPECT_EQ(0U, w_6.depth());
 
   Json_dom *i = new (std::nothrow) Json_int(1);
   Json_wrapper w_7(i);
@@ -510,6 +526,13 @@ TEST_F(JsonDomTest, WrapperTest) {
 
   // nested arrays
   vet_wrapper_length(thd, "[ 100, [ 200, 300 ] ]", 2);
+
+  // depth, computed from the DOM and directly from the binary value
+  vet_wrapper_depth(thd, "1", 1);
+  vet_wrapper_depth(thd, "[]", 1);
+  vet_wrapper_depth(thd, "{}", 1);
+  vet_wrapper_depth(thd, "[ 100, [ 200, 300 ] ]", 3);
+  vet_wrapper_depth(thd, "{ \"a\" : [ 1, { \"b\" : [] } ], \"c\" : 2 }", 4);
 }
 
 void vet_merge(char *left_text, char *right_text, std::string expected) {